@@ -473,6 +473,7 @@ class HermesRuntimeImpl final : public HermesRuntime,
     BRIDGE_INFO(double, info, allocatedBytes);
     BRIDGE_INFO(double, info, heapSize);
     BRIDGE_INFO(double, info, va);
+    BRIDGE_INFO(double, info, externalBytes);
     BRIDGE_INFO(int, info, numMarkStackOverflows);
     if (includeExpensive) {
       BRIDGE_INFO(double, info, mallocSizeEstimate);
@@ -511,6 +512,25 @@ class HermesRuntimeImpl final : public HermesRuntime,
 
 #undef BRIDGE_GEN_INFO
 
+#define BRIDGE_HISTOGRAM(NAME)                                     \
+  do {                                                             \
+    const ::hermes::LogHistogram &hist = info.timeHistograms.NAME; \
+    jsInfo["hermes_" #NAME "_count"] = hist.count();               \
+    jsInfo["hermes_" #NAME "_p50"] = hist.percentile(50);          \
+    jsInfo["hermes_" #NAME "_p90"] = hist.percentile(90);          \
+    jsInfo["hermes_" #NAME "_p99"] = hist.percentile(99);          \
+    jsInfo["hermes_" #NAME "_max"] = hist.max();                   \
+  } while (0)
+
+    // Pause times are in microseconds, allocation rates in bytes per
+    // millisecond.
+    BRIDGE_HISTOGRAM(youngGenPause);
+    BRIDGE_HISTOGRAM(oldGenPause);
+    BRIDGE_HISTOGRAM(concurrent);
+    BRIDGE_HISTOGRAM(allocationRate);
+
+#undef BRIDGE_HISTOGRAM
+
     return jsInfo;
   }
 
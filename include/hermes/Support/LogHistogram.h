@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_SUPPORT_LOGHISTOGRAM_H
+#define HERMES_SUPPORT_LOGHISTOGRAM_H
+
+#include "llvh/Support/MathExtras.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+namespace hermes {
+
+/// A fixed-size histogram of unsigned integer samples, in the style of an HDR
+/// histogram. Values below 2 * kSubBuckets get a bucket each. Above that, each
+/// power of two range is split into kSubBuckets linear buckets, so every
+/// recorded value is known to within 1 / kSubBuckets (12.5%) of its true value.
+/// Values of kMaxValue or larger all go into the last bucket.
+///
+/// Recording is a handful of integer operations and never allocates, so it is
+/// cheap enough to leave on in production. Histograms with the same layout can
+/// be merged, which makes them suitable for aggregating across runtimes.
+class LogHistogram {
+ public:
+  /// log2 of the number of linear buckets in each power of two range.
+  static constexpr unsigned kSubBucketBits = 3;
+  static constexpr unsigned kSubBuckets = 1u << kSubBucketBits;
+  /// Values are tracked precisely up to this many bits.
+  static constexpr unsigned kMaxValueBits = 32;
+  static constexpr uint64_t kMaxValue = (uint64_t)1 << kMaxValueBits;
+  static constexpr unsigned kNumBuckets =
+      (kMaxValueBits - kSubBucketBits + 1) * kSubBuckets;
+
+  LogHistogram() {
+    counts_.fill(0);
+  }
+
+  /// Add a sample with the given \p value.
+  void record(uint64_t value) {
+    counts_[bucketForValue(value)]++;
+    count_++;
+    max_ = std::max(max_, value);
+  }
+
+  /// Add all samples recorded in \p other to this histogram.
+  void merge(const LogHistogram &other) {
+    for (unsigned i = 0; i < kNumBuckets; ++i)
+      counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    max_ = std::max(max_, other.max_);
+  }
+
+  /// \return the number of samples recorded.
+  uint64_t count() const {
+    return count_;
+  }
+
+  /// \return the largest sample recorded, or zero if there are none.
+  uint64_t max() const {
+    return max_;
+  }
+
+  /// \return the number of samples that fell into bucket \p i.
+  uint64_t bucketCount(unsigned i) const {
+    return counts_[i];
+  }
+
+  /// \return an upper bound on the value below which \p pct percent of the
+  /// samples fall, or zero if there are no samples. The result is within one
+  /// bucket of the exact percentile, and never more than max().
+  uint64_t percentile(double pct) const {
+    if (count_ == 0)
+      return 0;
+    // The rank of the sample we are looking for, clamped so that the 100th
+    // percentile is the last sample and the 0th is the first.
+    uint64_t rank = static_cast<uint64_t>(pct / 100.0 * count_ + 0.5);
+    rank = std::min(std::max(rank, (uint64_t)1), count_);
+    uint64_t seen = 0;
+    for (unsigned i = 0; i < kNumBuckets; ++i) {
+      seen += counts_[i];
+      if (seen >= rank)
+        return std::min(bucketUpperBound(i), max_);
+    }
+    return max_;
+  }
+
+  /// \return the index of the bucket that \p value is counted in.
+  static unsigned bucketForValue(uint64_t value) {
+    if (value < 2 * kSubBuckets)
+      return value;
+    if (value >= kMaxValue)
+      return kNumBuckets - 1;
+    // The position of the highest set bit determines the power of two range,
+    // and the kSubBucketBits bits below it select the bucket within it.
+    const unsigned shift = llvh::Log2_64(value) - kSubBucketBits;
+    return (shift + 1) * kSubBuckets + (value >> shift) - kSubBuckets;
+  }
+
+  /// \return the smallest value counted in bucket \p i.
+  static uint64_t bucketLowerBound(unsigned i) {
+    assert(i < kNumBuckets && "Bucket out of range");
+    if (i < 2 * kSubBuckets)
+      return i;
+    const unsigned shift = i / kSubBuckets - 1;
+    return (uint64_t)(kSubBuckets + i % kSubBuckets) << shift;
+  }
+
+  /// \return the largest value counted in bucket \p i. The last bucket also
+  /// holds every value above kMaxValue.
+  static uint64_t bucketUpperBound(unsigned i) {
+    assert(i < kNumBuckets && "Bucket out of range");
+    if (i == kNumBuckets - 1)
+      return UINT64_MAX;
+    return bucketLowerBound(i + 1) - 1;
+  }
+
+ private:
+  /// The number of samples in each bucket.
+  std::array<uint32_t, kNumBuckets> counts_;
+  /// Total number of samples recorded.
+  uint64_t count_{0};
+  /// Largest sample recorded.
+  uint64_t max_{0};
+};
+
+} // namespace hermes
+
+#endif // HERMES_SUPPORT_LOGHISTOGRAM_H
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#ifndef HERMES_SUPPORT_TRACEMARKER_H
+#define HERMES_SUPPORT_TRACEMARKER_H
+
+#include <cstdint>
+
+namespace hermes {
+namespace tracemarker {
+
+/// \return true if trace markers can be written. On Linux this is the case
+/// when the ftrace trace_marker file could be opened for writing, which
+/// normally requires tracing to be set up by a privileged user. On every other
+/// platform it is false, and the functions below are no-ops.
+bool enabled();
+
+/// Write a counter sample called \p name with the given \p value to the kernel
+/// trace buffer. The marker uses the "C|pid|name|value" format understood by
+/// systrace, Perfetto and `perf script`, so the samples show up as a counter
+/// track next to the rest of the system trace.
+void counter(const char *name, int64_t value);
+
+} // namespace tracemarker
+} // namespace hermes
+
+#endif // HERMES_SUPPORT_TRACEMARKER_H
@@ -14,6 +14,7 @@
 #include "hermes/Public/GCConfig.h"
 #include "hermes/Public/GCTripwireContext.h"
 #include "hermes/Support/CheckedMalloc.h"
+#include "hermes/Support/LogHistogram.h"
 #include "hermes/Support/OSCompat.h"
 #include "hermes/Support/StatsAccumulator.h"
 #include "hermes/VM/AllocOptions.h"
@@ -307,6 +308,33 @@ class GCBase {
     StatsAccumulator<gcheapsize_t, uint64_t> usedAfter;
   };
 
+  /// The kinds of GC work whose wall time is tracked in GCTimeHistograms.
+  enum class GCTimeKind {
+    /// A young generation collection. The mutator is stopped throughout.
+    YoungGenPause,
+    /// The part of an old generation (or full) collection during which the
+    /// mutator is stopped. For a non-concurrent GC, this is the whole
+    /// collection.
+    OldGenPause,
+    /// An old generation collection that ran alongside the mutator, either on
+    /// a background thread or in increments, from start to finish.
+    Concurrent,
+  };
+
+  /// Distributions of GC times and allocation rates, kept for the lifetime of
+  /// the heap. Cheap enough to always be recorded.
+  struct GCTimeHistograms {
+    /// Wall times of young generation pauses, in microseconds.
+    LogHistogram youngGenPause;
+    /// Wall times of old generation pauses, in microseconds.
+    LogHistogram oldGenPause;
+    /// Wall times of concurrent old generation collections, in microseconds
+    /// (empty if the GC only collects the old generation in a pause).
+    LogHistogram concurrent;
+    /// Bytes allocated per millisecond between consecutive collections.
+    LogHistogram allocationRate;
+  };
+
   struct HeapInfo {
     /// Number of garbage collections (of any kind) since creation.
     unsigned numCollections{0};
@@ -321,6 +349,10 @@ class GCBase {
     /// auxiliary allocations owned by heap objects. (Calculated by querying
     /// each finalizable object to report its malloc usage.)
     unsigned mallocSizeEstimate{0};
+    /// Number of bytes of memory outside the JS heap that have been credited
+    /// to cells in it via creditExternalMemory (e.g. ArrayBuffer data and
+    /// external strings). This memory counts towards collection triggers.
+    uint64_t externalBytes{0};
     /// The total amount of Virtual Address space (VA) that the GC is using.
     uint64_t va{0};
     /// Cumulative number of mark stack overflows in full collections
@@ -331,6 +363,8 @@ class GCBase {
     /// Stats for collections in the young generation (zeroes if
     /// non-generational GC).
     CumulativeHeapStats youngGenStats;
+    /// Distributions of pause times and allocation rates.
+    GCTimeHistograms timeHistograms;
   };
 
 #ifndef NDEBUG
@@ -1075,6 +1109,15 @@ class GCBase {
   /// \p event, in the given cumulative stats struct.
   void recordGCStats(const GCAnalyticsEvent &event, CumulativeHeapStats *stats);
 
+  /// Record that GC work of the given \p kind took \p wallTime, both in the
+  /// time histograms and, if available, as a trace marker.
+  void recordGCTime(GCTimeKind kind, std::chrono::microseconds wallTime);
+
+  /// Record the allocation rate since the previous call, given the
+  /// \p totalAllocatedBytes in the heap so far. Should be called once at the
+  /// start of each collection that empties the allocation area.
+  void recordAllocationRate(uint64_t totalAllocatedBytes);
+
   /// Do any additional GC-specific logging that is useful before dying with
   /// out-of-memory.
   virtual void oomDetail(std::error_code reason);
@@ -1199,6 +1242,14 @@ class GCBase {
   // The cumulative GC stats.
   CumulativeHeapStats cumStats_;
 
+  /// Distributions of GC times, reported through getHeapInfo.
+  GCTimeHistograms timeHistograms_;
+
+  /// Time and total allocated bytes at the last call to recordAllocationRate.
+  std::chrono::time_point<std::chrono::steady_clock> lastAllocationRateTime_{
+      std::chrono::steady_clock::now()};
+  uint64_t lastAllocationRateBytes_{0};
+
   /// Name to indentify this heap in logs.
   std::string name_;
 
@@ -20,7 +20,6 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
-#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -228,6 +227,42 @@ class HadesGC final : public GCBase {
   class MarkWeakRootsAcceptor;
   class OldGen;
 
+  /// Storage for all of the WeakRefSlots in the system. Slots are allocated
+  /// out of fixed-size chunks that are never moved or released, so a slot's
+  /// address is stable for the lifetime of the GC. Freed slots are chained
+  /// together in a free list so they can be re-used by future allocations.
+  class WeakSlotStorage final {
+   public:
+    /// \return A slot initialized to \p init. Re-uses a free slot if one is
+    ///   available, otherwise carves a new one out of the last chunk.
+    WeakRefSlot *alloc(HermesValue init);
+
+    /// Push \p slot onto the free list. The slot must be unmarked.
+    void free(WeakRefSlot *slot);
+
+    /// Call \p callback on every slot, including free ones.
+    template <typename CallbackFunction>
+    void forEach(CallbackFunction callback);
+    template <typename CallbackFunction>
+    void forEach(CallbackFunction callback) const;
+
+    /// \return The number of bytes of malloc'd memory used by the chunks.
+    size_t mallocSize() const;
+
+   private:
+    /// Number of slots in a single chunk.
+    static constexpr size_t kSlotsPerChunk = 256;
+
+    /// Each chunk reserves kSlotsPerChunk slots up front and is never grown
+    /// past that, so the vector never reallocates its slots.
+    using Chunk = std::vector<WeakRefSlot>;
+
+    std::vector<Chunk> chunks_;
+
+    /// Pointer to the first free slot.
+    WeakRefSlot *firstFree_{nullptr};
+  };
+
   /// Similar to AlignedHeapSegment except it uses a free list.
   class HeapSegment final : public AlignedHeapSegment {
    public:
@@ -527,7 +562,14 @@ class HadesGC final : public GCBase {
   /// invalidated if they point to an object that is dead, and do not count
   /// towards whether an object is live or dead.
   /// Protected by weakRefMutex().
-  std::deque<WeakRefSlot> weakPointers_;
+  WeakSlotStorage weakPointers_;
+
+  /// Set during the STW pause once weak references have been cleared, and
+  /// reset by \c reclaimUnmarkedWeakSlots once the slots that weren't marked
+  /// have been freed. While it is set, newly allocated slots are marked so
+  /// that they aren't mistaken for unreachable ones.
+  /// Protected by weakRefMutex().
+  bool weakSlotsPendingReclaim_{false};
 
   /// Whoever holds this lock is permitted to modify data structures around the
   /// GC. This includes mark bits, free lists, etc.
@@ -589,10 +631,6 @@ class HadesGC final : public GCBase {
   /// collection, as well as the time an OG collection takes.
   std::unique_ptr<CollectionStats> ogCollectionStats_;
 
-  /// Pointer to the first free weak reference slot. Free weak refs are chained
-  /// together in a linked list.
-  WeakRefSlot *firstFreeWeak_{nullptr};
-
   /// The weighted average of the YG survival ratio over time.
   ExponentialMovingAverage ygAverageSurvivalRatio_;
 
@@ -618,9 +656,6 @@ class HadesGC final : public GCBase {
   /// necessary to create room).
   void *allocLongLived(uint32_t sz);
 
-  /// Frees the weak slot, so it can be re-used by future WeakRef allocations.
-  void freeWeakSlot(WeakRefSlot *slot);
-
   /// Perform a YG garbage collection. All live objects in YG will be evacuated
   /// to the OG.
   /// \param cause The cause of the GC, used for logging.
@@ -712,10 +747,23 @@ class HadesGC final : public GCBase {
   /// dead objects.
   void updateWeakReferencesForYoungGen();
 
-  /// Update all of the weak references, invalidate the ones that point to
-  /// dead objects, and free the ones that were not marked at all.
+  /// Invalidate all of the marked weak references that point to dead objects.
+  /// Slots that were not marked at all are left for
+  /// \c reclaimUnmarkedWeakSlots to free once the world is restarted.
   void updateWeakReferencesForOldGen();
 
+  /// Free the weak ref slots that were not marked during the last OG
+  /// collection, and unmark the rest. Run by the background thread at the
+  /// start of sweeping, so the mutator doesn't pay for it in the STW pause.
+  void reclaimUnmarkedWeakSlots();
+
+  /// While concurrent marking is running, mark from the values of WeakMap
+  /// entries whose keys are already known to be reachable. This does most of
+  /// the ephemeron fixpoint off of the mutator thread, so that
+  /// \c completeWeakMapMarking has little left to do in the STW pause.
+  /// \return true if any new values were pushed onto the mark worklist.
+  bool markReachableWeakMapValues(MarkAcceptor &acceptor);
+
   /// The WeakMap type in JS has special semantics for handling keys kept alive
   /// by only their values. In between marking and sweeping, this function is
   /// called to handle that special case.
@@ -793,6 +841,24 @@ inline T *HadesGC::makeA(uint32_t size, Args &&... args) {
       T(std::forward<Args>(args)...);
 }
 
+template <typename CallbackFunction>
+void HadesGC::WeakSlotStorage::forEach(CallbackFunction callback) {
+  for (Chunk &chunk : chunks_) {
+    for (WeakRefSlot &slot : chunk) {
+      callback(slot);
+    }
+  }
+}
+
+template <typename CallbackFunction>
+void HadesGC::WeakSlotStorage::forEach(CallbackFunction callback) const {
+  for (const Chunk &chunk : chunks_) {
+    for (const WeakRefSlot &slot : chunk) {
+      callback(slot);
+    }
+  }
+}
+
 /// \}
 
 } // namespace vm
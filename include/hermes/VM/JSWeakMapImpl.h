@@ -199,6 +199,10 @@ class JSWeakMapImplBase : public JSObject {
   /// a PointerBase.
   GCHermesValue *getValueDirect(GC *gc, const WeakRefKey &key);
 
+  /// Like the above, but for the entry that \p it refers to, which must not be
+  /// the end iterator. Avoids looking the key up again.
+  GCHermesValue *getValueDirect(GC *gc, KeyIterator it);
+
   /// Return a reference to the slot that contains the pointer to the storage
   /// for the values of the weak map.  Note that this returns a pointer into the
   /// interior of an object; must not be used in contexts where the object might
@@ -123,6 +123,15 @@ class MallocGC final : public GCBase {
   gcheapsize_t sizeLimit_;
   /// allocatedBytes_ is the current amount of memory stored in the heap.
   gcheapsize_t allocatedBytes_{0};
+  /// externalBytes_ is the amount of memory outside the heap credited to cells
+  /// in it.
+  uint64_t externalBytes_{0};
+  /// The part of externalBytes_ credited since the last collection. It isn't
+  /// part of the heap, but it counts towards sizeLimit_ when deciding whether
+  /// to collect. External memory that survived the last collection doesn't, so
+  /// that a large live external allocation can't force a collection on every
+  /// allocation.
+  uint64_t externalBytesSinceGC_{0};
 
  public:
   /// See comment in GCBase.
@@ -182,6 +191,15 @@ class MallocGC final : public GCBase {
   /// succeed.)
   bool canAllocExternalMemory(uint32_t size);
 
+  /// Add some external memory cost to a cell.
+  /// (Part of general GC API defined in GCBase.h).
+  /// \pre canAllocExternalMemory(size) is true.
+  void creditExternalMemory(GCCell *alloc, uint32_t size);
+
+  /// Remove some external memory cost from a cell.
+  /// (Part of general GC API defined in GCBase.h).
+  void debitExternalMemory(GCCell *alloc, uint32_t size);
+
   /// Collect all of the dead objects and symbols in the heap. Also invalidate
   /// weak pointers that point to dead objects.
   void collect(std::string cause);
@@ -334,8 +352,10 @@ inline void *MallocGC::alloc(uint32_t size) {
   if (shouldSanitizeHandles()) {
     collectBeforeAlloc(kHandleSanCauseForAnalytics, size);
   }
-  // Use subtraction to prevent overflow.
-  if (LLVM_UNLIKELY(size > sizeLimit_ - allocatedBytes_)) {
+  // Recently credited external memory counts towards the limit. The sum is
+  // computed in 64 bits, so it can't overflow.
+  if (LLVM_UNLIKELY(
+          allocatedBytes_ + externalBytesSinceGC_ + size > sizeLimit_)) {
     collectBeforeAlloc(kNaturalCauseForAnalytics, size);
   }
   // Add space for the header.
@@ -138,6 +138,11 @@ class StringPrimitive : public VariableSizeRuntimeCell {
   static constexpr uint32_t CONCAT_STRING_MIN_SIZE =
       256 > EXTERNAL_STRING_MIN_SIZE ? 256 : EXTERNAL_STRING_MIN_SIZE;
 
+  /// Slices of an external or buffered string resulting in this size or larger
+  /// share the storage of the original string instead of copying it. Below
+  /// this size copying is cheaper than the extra cell and the indirection.
+  static constexpr uint32_t SLICE_STRING_MIN_SIZE = 256;
+
   static bool classof(const GCCell *cell) {
     return kindInRange(
         cell->getKind(),
@@ -240,6 +245,9 @@ class StringPrimitive : public VariableSizeRuntimeCell {
       Handle<StringPrimitive> yHandle);
 
   /// Slice the StringPrimitive at \p str, \p length characters at \p start.
+  /// Slices of at least SLICE_STRING_MIN_SIZE characters of an external or
+  /// buffered string are BufferedStringPrimitives referring to the storage of
+  /// \p str, everything else is copied.
   /// \return new StringPrimitive, representing the sliced string.
   static CallResult<HermesValue> slice(
       Runtime *runtime,
@@ -627,6 +635,12 @@ class ExternalStringPrimitive final : public SymbolStringPrimitive {
 /// std::string. Each subsequent concatenation appends data to the std::string
 /// and allocates a new BufferedStringPrimitive referring to a prefix of it.
 ///
+/// BufferedStringPrimitive is also used for large slices of external and
+/// buffered strings (see StringPrimitive::slice()). A slice refers to a range
+/// starting at \c offset_ in the storage of the original string, and is never
+/// appended to in place, since the storage may belong to a string visible to
+/// JS.
+///
 /// A degenerate case could result from code that keeps a reference only to an
 /// early stage in the "concatenation chain", because it would keep the whole
 /// large string alive. Something like this:
@@ -692,21 +706,27 @@ class BufferedStringPrimitive final : public StringPrimitive {
   static const VTable vt;
 
   /// Construct a BufferedStringPrimitive with the specified length \p length
-  /// and the associated concatenation buffer \p storage. Note that the length
-  /// of the primitive may be smaller than the length of the buffer.
+  /// starting at \p offset in the associated concatenation buffer \p storage.
+  /// Note that the length of the primitive may be smaller than the length of
+  /// the buffer. If \p appendable is false, concatenation will never append to
+  /// \p storage in place.
   BufferedStringPrimitive(
       Runtime *runtime,
       uint32_t length,
-      Handle<ExternalStringPrimitive<T>> concatBuffer)
+      Handle<ExternalStringPrimitive<T>> concatBuffer,
+      uint32_t offset,
+      bool appendable)
       : StringPrimitive(
             runtime,
             &vt,
             sizeof(BufferedStringPrimitive<T>),
-            length) {
+            length),
+        offset_(offset),
+        appendable_(appendable) {
     concatBufferHV_.set(
         HermesValue::encodeObjectValue(*concatBuffer), &runtime->getHeap());
     assert(
-        concatBuffer->contents_.size() >= length &&
+        concatBuffer->contents_.size() >= (size_t)offset + length &&
         "length exceeds size of concatenation buffer");
   }
 
@@ -718,6 +738,24 @@ class BufferedStringPrimitive final : public StringPrimitive {
       uint32_t length,
       Handle<ExternalStringPrimitive<T>> storage);
 
+  /// Allocate a BufferedStringPrimitive referring to \p length characters at
+  /// \p start in \p str, without copying them.
+  /// \pre \p str must be an ExternalStringPrimitive<T> or a
+  /// BufferedStringPrimitive<T>.
+  static PseudoHandle<StringPrimitive> createSlice(
+      Runtime *runtime,
+      Handle<StringPrimitive> str,
+      uint32_t start,
+      uint32_t length);
+
+  /// \return true if the string ends at the end of the concatenation buffer
+  /// and may therefore be extended by appending to the buffer in place.
+  bool canAppendInPlace() const {
+    return appendable_ &&
+        (size_t)offset_ + getStringLength() ==
+        getConcatBuffer()->contents_.size();
+  }
+
   /// Append a new string to the concatenation buffer and allocate a new
   /// BufferedStringPrimitive representing the result.
   /// \pre The types must be compatible (cannot append UTF16 to ASCII) and the
@@ -749,7 +787,7 @@ class BufferedStringPrimitive final : public StringPrimitive {
 
   /// \return a const pointer to the first character of the string.
   const T *getRawPointer() const {
-    return getConcatBuffer()->getRawPointer();
+    return getConcatBuffer()->getRawPointer() + offset_;
   }
 
   /// A helper to cast \c concatBufferHV_ to a typed pointer to
@@ -769,6 +807,14 @@ class BufferedStringPrimitive final : public StringPrimitive {
   /// refactoring around compressed pointers, which require PointerBase to be
   /// passed to functions which didn't previously need it.
   GCHermesValue concatBufferHV_;
+
+  /// Index of the first character of this string in the concatenation buffer.
+  /// This is zero unless the string is a slice.
+  const uint32_t offset_;
+
+  /// Whether the concatenation buffer may be appended to in place. This is
+  /// false for slices.
+  const bool appendable_;
 };
 
 /// \return true if this is one of the BufferedStringPrimitive classes.
@@ -8,8 +8,12 @@
 #ifndef HERMES_VM_UTF16REF_H
 #define HERMES_VM_UTF16REF_H
 
+#include "hermes/Support/OptValue.h"
+
 #include "llvh/ADT/ArrayRef.h"
 
+#include <cstring>
+
 namespace llvh {
 class raw_ostream;
 }
@@ -43,6 +47,77 @@ bool stringRefEquals(llvh::ArrayRef<T1> str1, llvh::ArrayRef<T2> str2) {
   return std::equal(str1.begin(), str1.end(), str2.begin());
 }
 
+/// \return a pointer to the first occurrence of \p ch in [first, last), or
+/// nullptr if there is none. This is memchr, which the C library implements
+/// with vector instructions chosen at runtime.
+inline const char *findChar(const char *first, const char *last, char ch) {
+  return static_cast<const char *>(
+      std::memchr(first, static_cast<unsigned char>(ch), last - first));
+}
+
+/// \return a pointer to the first occurrence of \p ch in [first, last), or
+/// nullptr if there is none. There is no 16-bit memchr, so this scans for one
+/// byte of \p ch with memchr and checks the candidates it finds. It picks a
+/// non-zero byte where it can, because one byte of most characters in UTF-16
+/// text is zero.
+inline const char16_t *
+findChar(const char16_t *first, const char16_t *last, char16_t ch) {
+  unsigned char bytes[sizeof(char16_t)];
+  std::memcpy(bytes, &ch, sizeof(char16_t));
+  const unsigned which = bytes[0] == 0 ? 1 : 0;
+  const char *base = reinterpret_cast<const char *>(first);
+  const char *end = reinterpret_cast<const char *>(last);
+  const char *cur = base + which;
+  while (cur < end) {
+    const char *found =
+        static_cast<const char *>(std::memchr(cur, bytes[which], end - cur));
+    if (!found)
+      return nullptr;
+    const size_t offset = found - base;
+    // Only a byte at the same position within a character can be a match.
+    if (offset % sizeof(char16_t) == which) {
+      const char16_t *candidate = first + offset / sizeof(char16_t);
+      if (*candidate == ch)
+        return candidate;
+      cur = found + sizeof(char16_t);
+    } else {
+      cur = found + 1;
+    }
+  }
+  return nullptr;
+}
+
+/// Find the first occurrence of \p needle in \p haystack, starting at index
+/// \p start. Candidates for a match are found by scanning for the first
+/// character of \p needle with findChar(), and then compared with memcmp.
+/// \return the index of the match, or llvh::None if there is none. An empty
+/// \p needle matches at \p start.
+template <typename T>
+OptValue<uint32_t> stringRefIndexOf(
+    llvh::ArrayRef<T> haystack,
+    llvh::ArrayRef<T> needle,
+    uint32_t start) {
+  assert(start <= haystack.size() && "start is past the end of the haystack");
+  const size_t needleLen = needle.size();
+  if (needleLen == 0)
+    return start;
+  if (needleLen > haystack.size() - start)
+    return llvh::None;
+  const T *base = haystack.data();
+  // One past the last position where a match could start.
+  const T *end = base + haystack.size() - needleLen + 1;
+  const T first = needle[0];
+  for (const T *cur = base + start; cur < end; ++cur) {
+    cur = findChar(cur, end, first);
+    if (!cur)
+      return llvh::None;
+    if (std::memcmp(cur + 1, needle.data() + 1, (needleLen - 1) * sizeof(T)) ==
+        0)
+      return cur - base;
+  }
+  return llvh::None;
+}
+
 /// Compare two ArrayRef, \return +1 if str1 > str2, -1 if str1 < str2, 0
 /// otherwise.
 template <typename T1, typename T2>
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "hermes/Support/TraceMarker.h"
+
+#ifdef __linux__
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hermes {
+namespace tracemarker {
+
+/// \return a file descriptor for the ftrace trace_marker file, or -1 if it
+/// isn't available. The file is only opened once per process.
+static int markerFD() {
+  static const int fd = [] {
+    // Newer kernels mount tracefs on its own, older ones only under debugfs.
+    int res = open("/sys/kernel/tracing/trace_marker", O_WRONLY | O_CLOEXEC);
+    if (res < 0)
+      res = open(
+          "/sys/kernel/debug/tracing/trace_marker", O_WRONLY | O_CLOEXEC);
+    return res;
+  }();
+  return fd;
+}
+
+bool enabled() {
+  return markerFD() >= 0;
+}
+
+void counter(const char *name, int64_t value) {
+  const int fd = markerFD();
+  if (fd < 0)
+    return;
+  char buf[128];
+  int len = snprintf(
+      buf, sizeof(buf), "C|%d|%s|%" PRId64, (int)getpid(), name, value);
+  if (len <= 0)
+    return;
+  // A failed write only loses the sample, there is nothing else to do.
+  (void)!write(fd, buf, std::min<size_t>(len, sizeof(buf) - 1));
+}
+
+} // namespace tracemarker
+} // namespace hermes
+
+#else // !__linux__
+
+namespace hermes {
+namespace tracemarker {
+
+bool enabled() {
+  return false;
+}
+
+void counter(const char *, int64_t) {}
+
+} // namespace tracemarker
+} // namespace hermes
+
+#endif // __linux__
@@ -11,6 +11,7 @@
 #include "hermes/Platform/Logging.h"
 #include "hermes/Support/ErrorHandling.h"
 #include "hermes/Support/OSCompat.h"
+#include "hermes/Support/TraceMarker.h"
 #include "hermes/VM/CellKind.h"
 #include "hermes/VM/GCBase-inline.h"
 #include "hermes/VM/GCPointer-inline.h"
@@ -578,6 +579,7 @@ void GCBase::printAllCollectedStats(llvh::raw_ostream &os) {
 
 void GCBase::getHeapInfo(HeapInfo &info) {
   info.numCollections = cumStats_.numCollections;
+  info.timeHistograms = timeHistograms_;
 }
 
 #ifndef NDEBUG
@@ -726,6 +728,48 @@ void GCBase::recordGCStats(const GCAnalyticsEvent &event) {
   recordGCStats(event, &cumStats_);
 }
 
+void GCBase::recordGCTime(GCTimeKind kind, std::chrono::microseconds wallTime) {
+  const char *markerName = nullptr;
+  LogHistogram *histogram = nullptr;
+  switch (kind) {
+    case GCTimeKind::YoungGenPause:
+      markerName = "hermes_gc_yg_pause_us";
+      histogram = &timeHistograms_.youngGenPause;
+      break;
+    case GCTimeKind::OldGenPause:
+      markerName = "hermes_gc_og_pause_us";
+      histogram = &timeHistograms_.oldGenPause;
+      break;
+    case GCTimeKind::Concurrent:
+      markerName = "hermes_gc_concurrent_us";
+      histogram = &timeHistograms_.concurrent;
+      break;
+  }
+  histogram->record(wallTime.count());
+  tracemarker::counter(markerName, wallTime.count());
+}
+
+void GCBase::recordAllocationRate(uint64_t totalAllocatedBytes) {
+  const auto now = std::chrono::steady_clock::now();
+  const auto elapsedMs =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          now - lastAllocationRateTime_)
+          .count();
+  // Too short an interval gives a meaningless rate, so wait for more time to
+  // pass before taking a sample.
+  if (elapsedMs <= 0)
+    return;
+  assert(
+      totalAllocatedBytes >= lastAllocationRateBytes_ &&
+      "Total allocated bytes can't decrease");
+  const uint64_t rate =
+      (totalAllocatedBytes - lastAllocationRateBytes_) / elapsedMs;
+  timeHistograms_.allocationRate.record(rate);
+  tracemarker::counter("hermes_gc_alloc_bytes_per_ms", rate);
+  lastAllocationRateTime_ = now;
+  lastAllocationRateBytes_ = totalAllocatedBytes;
+}
+
 void GCBase::oom(std::error_code reason) {
 #ifdef HERMESVM_EXCEPTION_ON_OOM
   HeapInfo heapInfo;
@@ -120,6 +120,12 @@ GCHermesValue *JSWeakMapImplBase::getValueDirect(
   return &valueStorage_.get(gc->getPointerBase())->at(it->second);
 }
 
+GCHermesValue *JSWeakMapImplBase::getValueDirect(GC *gc, KeyIterator it) {
+  assert(gc->calledByGC() && "Should only be used by the GC implementation.");
+  assert(it != keys_end() && "Can't get the value of the end iterator");
+  return &valueStorage_.get(gc->getPointerBase())->at(it.mapIter->second);
+}
+
 GCPointerBase::StorageType &JSWeakMapImplBase::getValueStorageRef(GC *gc) {
   assert(gc->calledByGC() && "Should only be used by the GC implementation.");
   return valueStorage_.getLoc(gc);
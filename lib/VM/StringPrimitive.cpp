@@ -407,6 +407,17 @@ CallResult<HermesValue> StringPrimitive::slice(
   assert(
       start + length <= str->getStringLength() && "Invalid length for slice");
 
+  // Large slices of strings whose characters live outside the JS heap can
+  // refer to them directly.
+  if (length >= SLICE_STRING_MIN_SIZE &&
+      (str->isExternal() || isBufferedStringPrimitive(str.get()))) {
+    auto res = str->isASCII()
+        ? BufferedASCIIStringPrimitive::createSlice(runtime, str, start, length)
+        : BufferedUTF16StringPrimitive::createSlice(
+              runtime, str, start, length);
+    return HermesValue::encodeStringValue(res.get());
+  }
+
   SafeUInt32 safeLen(length);
 
   auto builder =
@@ -697,7 +708,37 @@ PseudoHandle<StringPrimitive> BufferedStringPrimitive<T>::create(
   // known, because BufferedStringPrimitive is derived from
   // VariableSizeRuntimeCell.
   auto *cell = runtime->makeAVariable<BufferedStringPrimitive<T>>(
-      sizeof(BufferedStringPrimitive<T>), runtime, length, storage);
+      sizeof(BufferedStringPrimitive<T>), runtime, length, storage, 0, true);
+  return createPseudoHandle<StringPrimitive>(cell);
+}
+
+template <typename T>
+PseudoHandle<StringPrimitive> BufferedStringPrimitive<T>::createSlice(
+    Runtime *runtime,
+    Handle<StringPrimitive> str,
+    uint32_t start,
+    uint32_t length) {
+  assert(
+      (size_t)start + length <= str->getStringLength() &&
+      "Invalid length for slice");
+  // Slicing a slice refers directly to the original storage, so that chains
+  // of slices don't keep the intermediate strings alive.
+  ExternalStringPrimitive<T> *buffer;
+  uint32_t offset = start;
+  if (auto *buffered = dyn_vmcast<BufferedStringPrimitive<T>>(str.get())) {
+    buffer = buffered->getConcatBuffer();
+    offset += buffered->offset_;
+  } else {
+    buffer = vmcast<ExternalStringPrimitive<T>>(str.get());
+  }
+  auto storage = runtime->makeHandle(buffer);
+  auto *cell = runtime->makeAVariable<BufferedStringPrimitive<T>>(
+      sizeof(BufferedStringPrimitive<T>),
+      runtime,
+      length,
+      storage,
+      offset,
+      false);
   return createPseudoHandle<StringPrimitive>(cell);
 }
 
@@ -778,7 +819,7 @@ PseudoHandle<StringPrimitive> BufferedStringPrimitive<T>::append(
       "cannot append UTF16 to ASCII");
 
   // Can't append if this is not the end of the string.
-  if (self->getStringLength() != storage->contents_.size()) {
+  if (!self->canAppendInPlace()) {
     noAlloc.release();
     return BufferedStringPrimitive<T>::create(runtime, selfHnd, rightHnd);
   }
@@ -804,8 +845,7 @@ PseudoHandle<StringPrimitive> internalConcatStringPrimitives(
 
   if (left->isASCII() && right->isASCII()) {
     if (auto *bufLeft = dyn_vmcast<BufferedASCIIStringPrimitive>(left)) {
-      if (bufLeft->getStringLength() ==
-          bufLeft->getConcatBuffer()->contents_.size())
+      if (bufLeft->canAppendInPlace())
         return BufferedASCIIStringPrimitive::append(
             Handle<BufferedASCIIStringPrimitive>::vmcast(leftHnd),
             runtime,
@@ -814,8 +854,7 @@ PseudoHandle<StringPrimitive> internalConcatStringPrimitives(
     return BufferedASCIIStringPrimitive::create(runtime, leftHnd, rightHnd);
   } else {
     if (auto *bufLeft = dyn_vmcast<BufferedUTF16StringPrimitive>(left)) {
-      if (bufLeft->getStringLength() ==
-          bufLeft->getConcatBuffer()->contents_.size()) {
+      if (bufLeft->canAppendInPlace()) {
         return BufferedUTF16StringPrimitive::append(
             Handle<BufferedUTF16StringPrimitive>::vmcast(leftHnd),
             runtime,
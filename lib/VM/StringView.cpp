@@ -28,6 +28,38 @@ UTF16Ref StringView::getUTF16Ref(
   return UTF16Ref(ptr, length());
 }
 
+OptValue<uint32_t> StringView::find(const StringView &needle, uint32_t start)
+    const {
+  assert(start <= length() && "start is past the end of the string");
+  if (isASCII()) {
+    ASCIIRef haystack(castToCharPtr(), length());
+    if (needle.isASCII()) {
+      return stringRefIndexOf(
+          haystack, ASCIIRef(needle.castToCharPtr(), needle.length()), start);
+    }
+    // A UTF16 needle can only occur in an ASCII string if all its characters
+    // are ASCII, in which case it can be narrowed.
+    llvh::SmallVector<char, 32> narrowed;
+    narrowed.reserve(needle.length());
+    for (char16_t ch : UTF16Ref(needle.castToChar16Ptr(), needle.length())) {
+      if (ch > 127)
+        return llvh::None;
+      narrowed.push_back(static_cast<char>(ch));
+    }
+    return stringRefIndexOf(
+        haystack, ASCIIRef(narrowed.data(), narrowed.size()), start);
+  }
+  UTF16Ref haystack(castToChar16Ptr(), length());
+  if (!needle.isASCII()) {
+    return stringRefIndexOf(
+        haystack, UTF16Ref(needle.castToChar16Ptr(), needle.length()), start);
+  }
+  llvh::SmallVector<char16_t, 32> widened;
+  needle.appendUTF16String(widened);
+  return stringRefIndexOf(
+      haystack, UTF16Ref(widened.data(), widened.size()), start);
+}
+
 llvh::raw_ostream &operator<<(llvh::raw_ostream &os, const StringView &sv) {
   if (sv.isASCII()) {
     return os << llvh::StringRef(sv.castToCharPtr(), sv.length());
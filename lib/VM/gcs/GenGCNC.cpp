@@ -1164,6 +1164,7 @@ void GenGC::getHeapInfo(HeapInfo &info) {
   info.allocatedBytes = usedDirect();
   info.heapSize = sizeDirect();
   info.totalAllocatedBytes = totalAllocatedBytes_ + bytesAllocatedSinceLastGC();
+  info.externalBytes = youngGen_.externalMemory() + oldGen_.externalMemory();
   info.va = segmentIndex_.size() * AlignedStorage::size();
   info.youngGenStats = youngGenCollectionCumStats_;
   info.fullStats = fullCollectionCumStats_;
@@ -1508,6 +1509,7 @@ GenGC::CollectionSection::CollectionSection(
 #endif
 
   gc_->updateTotalAllocStats();
+  gc_->recordAllocationRate(gc_->totalAllocatedBytes_);
 }
 
 GenGC::CollectionSection::~CollectionSection() {
@@ -1568,6 +1570,13 @@ void GenGC::CollectionSection::recordGCStats(
   gc_->recordGCStats(event);
   // Also record as a region-specific collection.
   gc_->recordGCStats(event, regionStats);
+  // Full collections stop the world for their whole duration.
+  gc_->recordGCTime(
+      regionStats == &gc_->fullCollectionCumStats_
+          ? GCTimeKind::OldGenPause
+          : GCTimeKind::YoungGenPause,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          wallEnd - wallStart_));
 
   LLVM_DEBUG(
       dbgs() << "End garbage collection. numCollected="
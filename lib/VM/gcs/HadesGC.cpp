@@ -220,10 +220,15 @@ class HadesGC::CollectionStats final {
   using TimePoint = std::chrono::time_point<Clock>;
   using Duration = std::chrono::microseconds;
 
-  CollectionStats(HadesGC *gc, std::string cause, std::string collectionType)
+  CollectionStats(
+      HadesGC *gc,
+      std::string cause,
+      std::string collectionType,
+      GCTimeKind timeKind)
       : gc_{gc},
         cause_{std::move(cause)},
-        collectionType_{std::move(collectionType)} {}
+        collectionType_{std::move(collectionType)},
+        timeKind_{timeKind} {}
   ~CollectionStats();
 
   void addCollectionType(const std::string &collectionType) {
@@ -286,6 +291,8 @@ class HadesGC::CollectionStats final {
   HadesGC *gc_;
   std::string cause_;
   std::string collectionType_;
+  /// The histogram the wall time of this collection is recorded in.
+  GCTimeKind timeKind_;
   TimePoint beginTime_{};
   TimePoint endTime_{};
   Duration cpuDuration_{};
@@ -312,6 +319,11 @@ HadesGC::CollectionStats::~CollectionStats() {
       // does not change due to a collection.
       /*postSize*/ size_,
       /*survivalRatio*/ survivalRatio()});
+  // A collection that is still running when the heap is destroyed has no end
+  // time, and no meaningful duration.
+  if (endTime_ != TimePoint{})
+    gc_->recordGCTime(
+        timeKind_, std::chrono::duration_cast<Duration>(endTime_ - beginTime_));
 }
 
 class HadesGC::EvacAcceptor final : public SlotAcceptorDefault {
@@ -1040,6 +1052,7 @@ void HadesGC::getHeapInfo(HeapInfo &info) {
   info.heapSize = (oldGen_.numSegments() + 1) * AlignedStorage::size();
   // If YG isn't empty, its bytes haven't been accounted for yet, add them here.
   info.totalAllocatedBytes = totalAllocatedBytes_ + youngGen().used();
+  info.externalBytes = externalBytes();
   info.va = info.heapSize;
 }
 
@@ -1056,9 +1069,7 @@ void HadesGC::getHeapInfoWithMallocSize(HeapInfo &info) {
   forAllObjs([&info](GCCell *cell) {
     info.mallocSizeEstimate += cell->getVT()->getMallocSize(cell);
   });
-  // A deque doesn't have a capacity, so the size is the lower bound.
-  info.mallocSizeEstimate +=
-      weakPointers_.size() * sizeof(decltype(weakPointers_)::value_type);
+  info.mallocSizeEstimate += weakPointers_.mallocSize();
 }
 
 void HadesGC::getCrashManagerHeapInfo(
@@ -1190,8 +1201,8 @@ void HadesGC::oldGenCollection(std::string cause) {
   // any) in addition to creating a new CollectionStats. It is desirable to
   // call the destructor here so that the analytics callback is invoked from the
   // mutator thread. This might also be done from checkTripwireAndResetStats.
-  ogCollectionStats_ =
-      llvh::make_unique<CollectionStats>(this, std::move(cause), "old");
+  ogCollectionStats_ = llvh::make_unique<CollectionStats>(
+      this, std::move(cause), "old", GCTimeKind::Concurrent);
   // NOTE: Leave CPU time as zero if the collection isn't concurrent, as the
   // times aren't useful.
   auto cpuTimeStart = oscompat::thread_cpu_time();
@@ -1286,8 +1297,13 @@ void HadesGC::incrementalCollect() {
       break;
     case Phase::Mark:
       // Drain some work from the mark worklist. If the work has finished
-      // completely, move on to CompleteMarking.
-      if (!oldGenMarker_->drainSomeWork())
+      // completely, mark through any WeakMap entries whose keys are known to
+      // be live, and only move on to CompleteMarking once that finds nothing
+      // new to mark. The WeakMap scan isn't bounded by the drain rate, so an
+      // incremental collection, which runs on the mutator, leaves it all for
+      // completeMarking instead.
+      if (!oldGenMarker_->drainSomeWork() &&
+          !(kConcurrentGC && markReachableWeakMapValues(*oldGenMarker_)))
         concurrentPhase_ = Phase::CompleteMarking;
       break;
     case Phase::CompleteMarking:
@@ -1300,6 +1316,13 @@ void HadesGC::incrementalCollect() {
           "completeMarking should advance concurrentPhase_ to sweep");
       break;
     case Phase::Sweep:
+      // Free the weak ref slots that weren't marked before sweeping the first
+      // segment. Only this thread resets the flag, so it can be read without
+      // holding the weak ref lock.
+      if (weakSlotsPendingReclaim_) {
+        reclaimUnmarkedWeakSlots();
+        break;
+      }
       // Calling oldGen_.sweepNext() will sweep the next segment.
       if (!oldGen_.sweepNext()) {
         // Finish any collection bookkeeping.
@@ -1335,6 +1358,7 @@ void HadesGC::waitForCompleteMarking() {
 
 void HadesGC::completeMarking() {
   assert(inGC() && "inGC_ must be set during the STW pause");
+  const auto pauseStart = std::chrono::steady_clock::now();
   if (ygCollectionStats_) {
     ygCollectionStats_->addCollectionType("(complete marking)");
   }
@@ -1362,12 +1386,12 @@ void HadesGC::completeMarking() {
   MarkWeakRootsAcceptor acceptor{*this};
   markWeakRoots(acceptor);
 
-  // Now free symbols and weak refs.
+  // Now free symbols and clear weak refs to dead objects.
   gcCallbacks_->freeSymbols(oldGenMarker_->markedSymbols());
-  // NOTE: If sweeping is done concurrently with YG collection, weak references
-  // could be handled during the sweep pass instead of the mark pass. The read
-  // barrier will need to be updated to handle the case where a WeakRef points
-  // to an now-empty cell.
+  // NOTE: Clearing weak refs has to happen while the world is stopped, since
+  // the read barrier can't tell that a WeakRef points to a dead cell once
+  // sweeping has started. Freeing the unmarked slots doesn't, and is deferred
+  // to the background thread.
   updateWeakReferencesForOldGen();
   // Change the phase to sweep here, before the STW lock is released. This
   // ensures that no mutator read barriers observe the WeakMapScan phase.
@@ -1375,6 +1399,10 @@ void HadesGC::completeMarking() {
 
   // Nothing needs oldGenMarker_ from this point onward.
   oldGenMarker_.reset();
+  recordGCTime(
+      GCTimeKind::OldGenPause,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - pauseStart));
 }
 
 void HadesGC::finalizeAll() {
@@ -1401,11 +1429,11 @@ void HadesGC::finalizeAllLocked() {
 
 void HadesGC::creditExternalMemory(GCCell *cell, uint32_t sz) {
   assert(canAllocExternalMemory(sz) && "Precondition");
-  if (inYoungGen(cell)) {
-    ygExternalBytes_ += sz;
-    // Instead of setting the effective end, which forces YG collections to
-    // happen sooner, check if the new total external bytes is large enough to
-    // maybe warrant an OG GC.
+  // Instead of setting the effective end, which forces YG collections to
+  // happen sooner, check if the new total external bytes is large enough to
+  // maybe warrant an OG GC. This applies to memory credited to OG cells too,
+  // since the OG collection can only be started by a YG collection.
+  const auto checkCollectionThreshold = [this]() {
     const uint64_t totalAllocated = allocatedBytes() + externalBytes();
     // Add one heap segment for YG capacity bytes.
     const uint64_t totalBytes =
@@ -1417,9 +1445,16 @@ void HadesGC::creditExternalMemory(GCCell *cell, uint32_t sz) {
       // on the next YG alloc.
       youngGen_->setEffectiveEnd(youngGen_->level());
     }
+  };
+  if (inYoungGen(cell)) {
+    ygExternalBytes_ += sz;
+    checkCollectionThreshold();
   } else {
     std::lock_guard<Mutex> lk{gcMutex_};
     oldGen_.creditExternalMemory(sz);
+    // The background thread updates the OG's allocated bytes while sweeping,
+    // so check the threshold before releasing the lock.
+    checkCollectionThreshold();
   }
 }
 
@@ -1612,34 +1647,49 @@ WeakRefSlot *HadesGC::allocWeakSlot(HermesValue init) {
   assert(
       !calledByBackgroundThread() &&
       "allocWeakSlot should only be called from the mutator");
-  // The weak ref mutex doesn't need to be held since weakPointers_ and
-  // firstFreeWeak_ are only modified while the world is stopped.
-  WeakRefSlot *slot;
-  if (firstFreeWeak_) {
-    assert(
-        firstFreeWeak_->state() == WeakSlotState::Free &&
-        "invalid free slot state");
-    slot = firstFreeWeak_;
-    firstFreeWeak_ = firstFreeWeak_->nextFree();
-    slot->reset(init);
-  } else {
-    weakPointers_.push_back({init});
-    slot = &weakPointers_.back();
-  }
-  if (isOldGenMarking_) {
+  // The weak ref mutex needs to be held since the background thread frees
+  // unmarked slots concurrently at the start of sweeping.
+  WeakRefLock lk{weakRefMutex()};
+  WeakRefSlot *const slot = weakPointers_.alloc(init);
+  if (isOldGenMarking_ || weakSlotsPendingReclaim_) {
     // During the mark phase, if a WeakRef is created, it might not be marked
     // if the object holding this new WeakRef has already been visited.
-    // This doesn't need the WeakRefMutex because nothing is using this slot
-    // yet.
+    // Between the STW pause and reclaimUnmarkedWeakSlots, an unmarked slot
+    // would be freed out from under its owner.
     slot->mark();
   }
   return slot;
 }
 
-void HadesGC::freeWeakSlot(WeakRefSlot *slot) {
-  // Sets the given WeakRefSlot to point to firstFreeWeak_ instead of a cell.
-  slot->free(firstFreeWeak_);
-  firstFreeWeak_ = slot;
+WeakRefSlot *HadesGC::WeakSlotStorage::alloc(HermesValue init) {
+  if (firstFree_) {
+    assert(
+        firstFree_->state() == WeakSlotState::Free &&
+        "invalid free slot state");
+    WeakRefSlot *const slot = firstFree_;
+    firstFree_ = firstFree_->nextFree();
+    slot->reset(init);
+    return slot;
+  }
+  if (chunks_.empty() || chunks_.back().size() == kSlotsPerChunk) {
+    chunks_.emplace_back();
+    chunks_.back().reserve(kSlotsPerChunk);
+  }
+  Chunk &chunk = chunks_.back();
+  assert(chunk.size() < chunk.capacity() && "Chunk would be reallocated");
+  chunk.emplace_back(init);
+  return &chunk.back();
+}
+
+void HadesGC::WeakSlotStorage::free(WeakRefSlot *slot) {
+  // Sets the given WeakRefSlot to point to firstFree_ instead of a cell.
+  slot->free(firstFree_);
+  firstFree_ = slot;
+}
+
+size_t HadesGC::WeakSlotStorage::mallocSize() const {
+  return chunks_.capacity() * sizeof(Chunk) +
+      chunks_.size() * kSlotsPerChunk * sizeof(WeakRefSlot);
 }
 
 void HadesGC::forAllObjs(const std::function<void(GCCell *)> &callback) {
@@ -1682,12 +1732,14 @@ bool HadesGC::dbgContains(const void *p) const {
 void HadesGC::trackReachable(CellKind kind, unsigned sz) {}
 
 size_t HadesGC::countUsedWeakRefs() const {
+  // The background thread frees unmarked slots while sweeping.
+  WeakRefLock lk{const_cast<HadesGC *>(this)->weakRefMutex()};
   size_t count = 0;
-  for (auto &slot : weakPointers_) {
+  weakPointers_.forEach([&count](const WeakRefSlot &slot) {
     if (slot.state() != WeakSlotState::Free) {
       ++count;
     }
-  }
+  });
   return count;
 }
 
@@ -1917,7 +1969,8 @@ GCCell *HadesGC::OldGen::search(uint32_t sz) {
 void HadesGC::youngGenCollection(
     std::string cause,
     bool forceOldGenCollection) {
-  ygCollectionStats_ = llvh::make_unique<CollectionStats>(this, cause, "young");
+  ygCollectionStats_ = llvh::make_unique<CollectionStats>(
+      this, cause, "young", GCTimeKind::YoungGenPause);
   auto cpuTimeStart = oscompat::thread_cpu_time();
   ygCollectionStats_->setBeginTime();
   ygCollectionStats_->setBeforeSizes(
@@ -1939,6 +1992,7 @@ void HadesGC::youngGenCollection(
   const uint64_t usedBefore = youngGen().used();
   // YG is about to be emptied, add all of the allocations.
   totalAllocatedBytes_ += usedBefore;
+  recordAllocationRate(totalAllocatedBytes_);
   // Attempt to promote the YG segment to OG if the flag is set. If this call
   // fails for any reason, proceed with a GC.
   if (promoteYoungGenToOldGen()) {
@@ -2204,16 +2258,16 @@ void HadesGC::finalizeYoungGenObjects() {
 
 void HadesGC::updateWeakReferencesForYoungGen() {
   assert(gcMutex_ && "gcMutex must be held when updating weak refs");
-  for (auto &slot : weakPointers_) {
+  weakPointers_.forEach([this](WeakRefSlot &slot) {
     switch (slot.state()) {
       case WeakSlotState::Free:
         break;
 
       case WeakSlotState::Marked:
         // WeakRefSlots may only be marked while an OG collection is in the mark
-        // phase or in the STW pause. The OG collection should unmark any slots
-        // after it is complete.
-        assert(isOldGenMarking_);
+        // phase, or before its unmarked slots have been reclaimed. The OG
+        // collection should unmark any slots after it is complete.
+        assert(isOldGenMarking_ || weakSlotsPendingReclaim_);
         LLVM_FALLTHROUGH;
       case WeakSlotState::Unmarked: {
         // Both marked and unmarked weak ref slots need to be updated.
@@ -2241,37 +2295,102 @@ void HadesGC::updateWeakReferencesForYoungGen() {
         break;
       }
     }
-  }
+  });
 }
 
 void HadesGC::updateWeakReferencesForOldGen() {
-  for (auto &slot : weakPointers_) {
+  assert(
+      !weakSlotsPendingReclaim_ &&
+      "Previous collection didn't reclaim its weak slots");
+  weakPointers_.forEach([](WeakRefSlot &slot) {
+    // Unmarked slots are unreachable, so their contents don't matter. They
+    // are freed later by reclaimUnmarkedWeakSlots.
+    if (slot.state() != WeakSlotState::Marked || !slot.hasPointer()) {
+      return;
+    }
+    auto *const cell = static_cast<GCCell *>(slot.getPointer());
+    // If the object isn't live, clear the weak ref.
+    // YG has all of its mark bits set whenever there's no YG collection
+    // happening, so this also excludes clearing any pointers to YG objects.
+    if (!HeapSegment::getCellMarkBit(cell)) {
+      slot.clearPointer();
+    }
+  });
+  weakSlotsPendingReclaim_ = true;
+}
+
+void HadesGC::reclaimUnmarkedWeakSlots() {
+  assert(gcMutex_ && "gcMutex must be held when reclaiming weak slots");
+  assert(concurrentPhase_ == Phase::Sweep && "Must be called when sweeping");
+  WeakRefLock lk{weakRefMutex()};
+  weakPointers_.forEach([this](WeakRefSlot &slot) {
     switch (slot.state()) {
       case WeakSlotState::Free:
         // Skip free weak slots.
         break;
-      case WeakSlotState::Marked: {
+      case WeakSlotState::Marked:
         // Set all allocated slots to unmarked.
         slot.unmark();
-        if (!slot.hasPointer()) {
-          // Skip non-pointers.
-          break;
-        }
-        auto *const cell = static_cast<GCCell *>(slot.getPointer());
-        // If the object isn't live, clear the weak ref.
-        // YG has all of its mark bits set whenever there's no YG collection
-        // happening, so this also excludes clearing any pointers to YG objects.
-        if (!HeapSegment::getCellMarkBit(cell)) {
-          slot.clearPointer();
-        }
         break;
-      }
-      case WeakSlotState::Unmarked: {
-        freeWeakSlot(&slot);
+      case WeakSlotState::Unmarked:
+        weakPointers_.free(&slot);
         break;
+    }
+  });
+  weakSlotsPendingReclaim_ = false;
+}
+
+bool HadesGC::markReachableWeakMapValues(MarkAcceptor &acceptor) {
+  assert(gcMutex_ && "gcMutex must be held while marking");
+  bool foundNewValue = false;
+  // Index instead of iterating, since the lock is dropped between maps.
+  for (size_t i = 0; i < acceptor.reachableWeakMaps().size(); ++i) {
+    JSWeakMap *const weakMap = acceptor.reachableWeakMaps()[i];
+    // The mutator only adds or removes keys of a WeakMap while holding the
+    // weak ref lock, so the key map can be safely iterated while it is held.
+    // Only hold it for one map at a time, so the mutator isn't blocked for the
+    // whole scan.
+    WeakRefLock lk{weakRefMutex()};
+    void *const storage = GCPointerBase::storageTypeToPointer(
+        weakMap->getValueStorageRef(this), getPointerBase());
+    // Storage in YG might still be getting initialized by the mutator, leave
+    // it for the STW pause.
+    if (!storage || inYoungGen(storage)) {
+      continue;
+    }
+    // Like the rest of concurrent marking, the value storage might be written
+    // to by the mutator while it is read here. Any value overwritten after the
+    // start of the collection is caught by the write barrier, and anything
+    // missed here is picked up by completeWeakMapMarking.
+    TsanIgnoreReadsBegin();
+    for (auto it = weakMap->keys_begin(), end = weakMap->keys_end(); it != end;
+         it++) {
+      // Don't go through the WeakRef, since that would execute a read barrier
+      // from the background thread.
+      const WeakRefSlot *const keySlot = it->ref.unsafeGetSlot();
+      if (!keySlot->hasPointer() ||
+          !HeapSegment::getCellMarkBit(
+              static_cast<GCCell *>(keySlot->getPointer()))) {
+        // Key isn't known to be reachable yet, it might be later.
+        continue;
+      }
+      GCHermesValue *const valPtr = weakMap->getValueDirect(this, it);
+      if (inYoungGen(valPtr)) {
+        continue;
+      }
+      HermesValue val = *valPtr;
+      if (!val.isPointer()) {
+        continue;
+      }
+      auto *const valCell = static_cast<GCCell *>(val.getPointer());
+      if (!HeapSegment::getCellMarkBit(valCell)) {
+        acceptor.accept(val);
+        foundNewValue = true;
       }
     }
+    TsanIgnoreReadsEnd();
   }
+  return foundNewValue;
 }
 
 void HadesGC::completeWeakMapMarking(MarkAcceptor &acceptor) {
@@ -198,6 +198,22 @@ MallocGC::~MallocGC() {
   }
 }
 
+void MallocGC::creditExternalMemory(GCCell *, uint32_t size) {
+  assert(canAllocExternalMemory(size) && "Precondition");
+  externalBytes_ += size;
+  externalBytesSinceGC_ += size;
+}
+
+void MallocGC::debitExternalMemory(GCCell *, uint32_t size) {
+  assert(
+      externalBytes_ >= size &&
+      "Debiting more native memory than was credited");
+  externalBytes_ -= size;
+  // externalBytesSinceGC_ was reset by the last collection, and may not
+  // include the memory being debited.
+  externalBytesSinceGC_ -= std::min<uint64_t>(externalBytesSinceGC_, size);
+}
+
 void MallocGC::collectBeforeAlloc(std::string cause, uint32_t size) {
   const auto growSizeLimit = [this, size](gcheapsize_t sizeLimit) {
     // Either double the size limit, or increase to size, at a max of maxSize_.
@@ -214,10 +230,11 @@ void MallocGC::collectBeforeAlloc(std::string cause, uint32_t size) {
       size <= sizeLimit_ &&
       "Should be guaranteed not to be asking for more space than the heap can "
       "provide");
-  // Check for memory pressure conditions to do a collection.
-  // Use subtraction to prevent overflow.
+  // Check for memory pressure conditions to do a collection. External memory
+  // credited since the last collection counts towards the pressure, even
+  // though it isn't part of the heap.
 #ifndef HERMESVM_SANITIZE_HANDLES
-  if (allocatedBytes_ < sizeLimit_ - size) {
+  if (allocatedBytes_ + externalBytesSinceGC_ < sizeLimit_ - size) {
     return;
   }
 #endif
@@ -266,6 +283,7 @@ void MallocGC::collect(std::string cause) {
   const auto wallStart = steady_clock::now();
   const auto cpuStart = oscompat::thread_cpu_time();
   auto allocatedBefore = allocatedBytes_;
+  recordAllocationRate(totalAllocatedBytes_);
 
   resetStats();
 
@@ -359,6 +377,9 @@ void MallocGC::collect(std::string cause) {
 #ifdef HERMES_SLOW_DEBUG
   checkWellFormed();
 #endif
+  // External memory that survived this collection no longer counts towards
+  // the next one.
+  externalBytesSinceGC_ = 0;
   // Grow the size limit if the heap is still more than 75% full.
   if (allocatedBytes_ >= sizeLimit_ * 3 / 4) {
     sizeLimit_ = std::min(maxSize_, sizeLimit_ * 2);
@@ -385,6 +406,10 @@ void MallocGC::collect(std::string cause) {
       allocatedBefore ? (allocatedBytes_ * 1.0) / allocatedBefore : 0};
 
   recordGCStats(event);
+  recordGCTime(
+      GCTimeKind::OldGenPause,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          wallEnd - wallStart));
   checkTripwire(allocatedBytes_);
 }
 
@@ -468,6 +493,7 @@ void MallocGC::resetStats() {
 void MallocGC::getHeapInfo(HeapInfo &info) {
   GCBase::getHeapInfo(info);
   info.allocatedBytes = allocatedBytes_;
+  info.externalBytes = externalBytes_;
   // MallocGC does not have a heap size.
   info.heapSize = 0;
 }
@@ -0,0 +1,59 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// RUN: %hermes -gc-init-heap=4M -O -Xhermes-internal-test-methods %s | %FileCheck --match-full-lines %s
+// RUN: %hermes -O -emit-binary -out %t.hbc %s && %hermes -gc-init-heap=4M -Xhermes-internal-test-methods %t.hbc | %FileCheck --match-full-lines %s
+
+"use strict";
+
+// Values of a WeakMap whose keys are reachable must survive, even when they
+// are only discovered by following a long ephemeron chain while the old
+// generation is being collected in the background.
+// CHECK-LABEL: Start
+print("Start");
+
+var kChainLength = 2000;
+var reachableKey = {};
+
+function makeChain() {
+  var map = new WeakMap();
+  var key = reachableKey;
+  for (var i = 0; i < kChainLength; i++) {
+    // Each value is only reachable through the map, and is the next key.
+    var value = {index: i, payload: new Array(16).fill(i)};
+    map.set(key, value);
+    key = value;
+  }
+  return map;
+}
+
+function checkChain(map) {
+  var key = reachableKey;
+  for (var i = 0; i < kChainLength; i++) {
+    var value = map.get(key);
+    if (value === undefined || value.index !== i || value.payload[15] !== i)
+      return false;
+    key = value;
+  }
+  return true;
+}
+
+var map = makeChain();
+// Allocate enough to run several old generation collections while the chain
+// is live, checking it between rounds.
+var ok = true;
+for (var round = 0; round < 20; round++) {
+  var garbage = [];
+  for (var i = 0; i < 20000; i++)
+    garbage.push({a: i, b: [i]});
+  ok = ok && checkChain(map);
+}
+gc();
+// CHECK-NEXT: true
+print(ok && checkChain(map));
+// CHECK-NEXT: 2000
+print(HermesInternal.getWeakSize(map));
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "hermes/Support/LogHistogram.h"
+
+using hermes::LogHistogram;
+
+namespace {
+
+TEST(LogHistogramTest, SmallValuesHaveOwnBuckets) {
+  for (unsigned i = 0; i < 2 * LogHistogram::kSubBuckets; ++i) {
+    EXPECT_EQ(i, LogHistogram::bucketForValue(i));
+    EXPECT_EQ(i, LogHistogram::bucketLowerBound(i));
+    EXPECT_EQ(i, LogHistogram::bucketUpperBound(i));
+  }
+}
+
+TEST(LogHistogramTest, BucketForValue) {
+  // From 16 up, each power of two range is split into 8 buckets.
+  EXPECT_EQ(16u, LogHistogram::bucketForValue(16));
+  EXPECT_EQ(16u, LogHistogram::bucketForValue(17));
+  EXPECT_EQ(17u, LogHistogram::bucketForValue(18));
+  EXPECT_EQ(23u, LogHistogram::bucketForValue(31));
+  EXPECT_EQ(24u, LogHistogram::bucketForValue(32));
+  EXPECT_EQ(24u, LogHistogram::bucketForValue(35));
+  EXPECT_EQ(25u, LogHistogram::bucketForValue(36));
+  // Everything from kMaxValue up goes in the last bucket.
+  const unsigned last = LogHistogram::kNumBuckets - 1;
+  EXPECT_EQ(last, LogHistogram::bucketForValue(LogHistogram::kMaxValue));
+  EXPECT_EQ(last, LogHistogram::bucketForValue(UINT64_MAX));
+}
+
+TEST(LogHistogramTest, BucketBoundsRoundTrip) {
+  for (unsigned i = 0; i < LogHistogram::kNumBuckets; ++i) {
+    const uint64_t lower = LogHistogram::bucketLowerBound(i);
+    const uint64_t upper = LogHistogram::bucketUpperBound(i);
+    EXPECT_EQ(i, LogHistogram::bucketForValue(lower)) << "bucket " << i;
+    EXPECT_EQ(i, LogHistogram::bucketForValue(upper)) << "bucket " << i;
+    if (i > 0) {
+      EXPECT_EQ(LogHistogram::bucketUpperBound(i - 1) + 1, lower);
+    }
+    // Each bucket is at most 1/kSubBuckets of its lower bound wide.
+    if (i >= 2 * LogHistogram::kSubBuckets && i < LogHistogram::kNumBuckets - 1)
+      EXPECT_LE(upper - lower + 1, lower / LogHistogram::kSubBuckets);
+  }
+}
+
+TEST(LogHistogramTest, EmptyPercentile) {
+  LogHistogram hist;
+  EXPECT_EQ(0u, hist.count());
+  EXPECT_EQ(0u, hist.max());
+  EXPECT_EQ(0u, hist.percentile(50));
+  EXPECT_EQ(0u, hist.percentile(100));
+}
+
+TEST(LogHistogramTest, Percentile) {
+  LogHistogram hist;
+  for (uint64_t i = 1; i <= 100; ++i)
+    hist.record(i);
+  EXPECT_EQ(100u, hist.count());
+  EXPECT_EQ(100u, hist.max());
+  // The result is the upper bound of the bucket the sample falls into.
+  EXPECT_EQ(1u, hist.percentile(0));
+  EXPECT_EQ(10u, hist.percentile(10));
+  EXPECT_EQ(51u, hist.percentile(50));
+  EXPECT_EQ(95u, hist.percentile(90));
+  // Never more than the largest sample.
+  EXPECT_EQ(100u, hist.percentile(99));
+  EXPECT_EQ(100u, hist.percentile(100));
+}
+
+TEST(LogHistogramTest, Merge) {
+  LogHistogram a;
+  LogHistogram b;
+  a.record(5);
+  a.record(1000);
+  b.record(5);
+  b.record(LogHistogram::kMaxValue + 1);
+  a.merge(b);
+  EXPECT_EQ(4u, a.count());
+  EXPECT_EQ(LogHistogram::kMaxValue + 1, a.max());
+  EXPECT_EQ(2u, a.bucketCount(5));
+  EXPECT_EQ(1u, a.bucketCount(LogHistogram::bucketForValue(1000)));
+  EXPECT_EQ(1u, a.bucketCount(LogHistogram::kNumBuckets - 1));
+  EXPECT_EQ(5u, a.percentile(50));
+}
+
+} // namespace
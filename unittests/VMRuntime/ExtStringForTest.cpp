@@ -11,12 +11,21 @@
 #include "hermes/VM/HeapAlign.h"
 #include "hermes/VM/StringPrimitive.h"
 
+#include <algorithm>
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Winvalid-offsetof"
 
 namespace hermes {
 namespace vm {
 
+/// \return the size to allocate for an ExtStringForTest. Some GCs can't
+/// allocate cells as small as the class itself.
+static uint32_t allocSize() {
+  return std::max(
+      heapAlignSize(sizeof(ExtStringForTest)), GC::minAllocationSize());
+}
+
 const VTable ExtStringForTest::vt{
     ExternalStringPrimitive<char>::getCellKind(),
     0,
@@ -47,8 +56,9 @@ void ExtStringForTest::releaseMem(GC *gc) {
 ExtStringForTest *ExtStringForTest::create(
     DummyRuntime &runtime,
     unsigned length) {
+  const uint32_t size = allocSize();
   auto res = runtime.makeAVariable<ExtStringForTest, HasFinalizer::Yes>(
-      sizeof(ExtStringForTest), &runtime.getHeap(), length);
+      size, &runtime.getHeap(), size, length);
   runtime.gc.creditExternalMemory(res, length);
   return res;
 }
@@ -57,10 +67,11 @@ ExtStringForTest *ExtStringForTest::create(
 ExtStringForTest *ExtStringForTest::createLongLived(
     DummyRuntime &runtime,
     unsigned length) {
+  const uint32_t size = allocSize();
   auto res =
       runtime
           .makeAVariable<ExtStringForTest, HasFinalizer::Yes, LongLived::Yes>(
-              sizeof(ExtStringForTest), &runtime.getHeap(), length);
+              size, &runtime.getHeap(), size, length);
   runtime.gc.creditExternalMemory(res, length);
   return res;
 }
@@ -25,9 +25,8 @@ class ExtStringForTest final : public VariableSizeRuntimeCell {
 
   unsigned length;
 
-  ExtStringForTest(GC *gc, unsigned const length)
-      : VariableSizeRuntimeCell(gc, &vt, sizeof(ExtStringForTest)),
-        length(length) {}
+  ExtStringForTest(GC *gc, uint32_t size, unsigned const length)
+      : VariableSizeRuntimeCell(gc, &vt, size), length(length) {}
 
   ~ExtStringForTest() = default;
 
@@ -5,8 +5,6 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-#ifdef HERMESVM_GC_NONCONTIG_GENERATIONAL
-
 #include "gtest/gtest.h"
 
 #include "EmptyCell.h"
@@ -14,7 +12,9 @@
 #include "TestHelpers.h"
 #include "hermes/VM/GC.h"
 #include "hermes/VM/GCCell.h"
+#ifdef HERMESVM_GC_NONCONTIG_GENERATIONAL
 #include "hermes/VM/GenGCHeapSegment.h"
+#endif
 
 #include <deque>
 
@@ -53,6 +53,7 @@ MetadataTableForTests getMetadataTable() {
   return MetadataTableForTests(storage);
 }
 
+#ifdef HERMESVM_GC_NONCONTIG_GENERATIONAL
 namespace {
 const size_t kMaxYoungGenSize = GenGCHeapSegment::maxSize();
 } // namespace
@@ -277,6 +278,96 @@ TEST(ExtMemNonParamTests, ExtMemDoesNotBreakFullGC) {
   rt.collect();
 }
 
+#endif // HERMESVM_GC_NONCONTIG_GENERATIONAL
+
+TEST(ExtMemNonParamTests, ExtMemReportedInHeapInfo) {
+  auto runtime =
+      DummyRuntime::create(getMetadataTable(), TestGCConfigFixedSize(1 << 24));
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.gc;
+
+  std::deque<GCCell *> roots;
+  const unsigned kExtSize = 1 << 16;
+
+  roots.push_back(ExtStringForTest::create(rt, kExtSize));
+  rt.pointerRoots.push_back(&roots.back());
+  roots.push_back(ExtStringForTest::createLongLived(rt, kExtSize));
+  rt.pointerRoots.push_back(&roots.back());
+
+  GCBase::HeapInfo info;
+  gc.getHeapInfo(info);
+  EXPECT_EQ(2 * kExtSize, info.externalBytes);
+
+  // Moving the young-gen cell to the old gen keeps its external memory.
+  rt.collect();
+  gc.getHeapInfo(info);
+  EXPECT_EQ(2 * kExtSize, info.externalBytes);
+
+  vmcast<ExtStringForTest>(roots.front())->releaseMem(&gc);
+  gc.getHeapInfo(info);
+  EXPECT_EQ(kExtSize, info.externalBytes);
+}
+
+#ifdef HERMESVM_GC_MALLOC
+TEST(ExtMemNonParamTests, MallocExtMemTriggersCollectionOnce) {
+  const gcheapsize_t kHeapSize = 1 << 20;
+  auto runtime = DummyRuntime::create(
+      getMetadataTable(), TestGCConfigFixedSize(kHeapSize));
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.gc;
+
+  std::deque<GCCell *> roots;
+  // Credit as much external memory as the whole heap. The next allocation
+  // should collect.
+  roots.push_back(ExtStringForTest::create(rt, kHeapSize));
+  rt.pointerRoots.push_back(&roots.back());
+  const unsigned gcsBefore = gc.getNumGCs();
+  (void)ExtStringForTest::create(rt, 0);
+  EXPECT_EQ(gcsBefore + 1, gc.getNumGCs());
+
+  // The external memory survived that collection, so it must not force
+  // another collection on every following allocation.
+  for (unsigned i = 0; i < 100; ++i) {
+    (void)ExtStringForTest::create(rt, 0);
+  }
+  EXPECT_EQ(gcsBefore + 1, gc.getNumGCs());
+}
+#endif
+
+#ifdef HERMESVM_GC_HADES
+TEST(ExtMemNonParamTests, HadesOldGenExtMemTriggersCollection) {
+  const gcheapsize_t kMaxHeapSize = 1 << 28;
+  auto runtime = DummyRuntime::create(
+      getMetadataTable(),
+      GCConfig::Builder(kTestGCConfigBuilder)
+          .withInitHeapSize(1 << 20)
+          .withMaxHeapSize(kMaxHeapSize)
+          .build());
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.gc;
+
+  std::deque<GCCell *> roots;
+  roots.push_back(ExtStringForTest::createLongLived(rt, 0));
+  rt.pointerRoots.push_back(&roots.back());
+
+  // Credit enough external memory to an old gen cell to take the heap well
+  // over the collection threshold, which also counts a segment for the young
+  // gen. The next young gen allocation should then collect, even though the
+  // young gen is nearly empty.
+  GCBase::HeapInfo info;
+  gc.getHeapInfo(info);
+  const unsigned kExtSize = 4 * (info.heapSize + GC::maxAllocationSize());
+  ASSERT_LE(kExtSize, kMaxHeapSize);
+  roots.push_back(ExtStringForTest::createLongLived(rt, kExtSize));
+  rt.pointerRoots.push_back(&roots.back());
+
+  const unsigned gcsBefore = gc.getNumGCs();
+  (void)ExtStringForTest::create(rt, 0);
+  EXPECT_LT(gcsBefore, gc.getNumGCs());
+}
+#endif
+
+#ifdef HERMESVM_GC_NONCONTIG_GENERATIONAL
 TEST(ExtMemNonParamDeathTest, SaturateYoungGen) {
   // Fill the heap up to such an extent that the YoungGen is forced to hold a
   // cell with an external allocation larger than the YoungGen's own size.
@@ -315,6 +406,6 @@ TEST(ExtMemNonParamDeathTest, SaturateYoungGen) {
   EXPECT_OOM(ExtStringForTest::create(rt, kExtAllocSize));
 }
 
-} // namespace
-
 #endif // HERMESVM_GC_NONCONTIG_GENERATIONAL
+
+} // namespace
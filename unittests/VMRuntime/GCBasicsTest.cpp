@@ -12,6 +12,7 @@
 #include "hermes/VM/GC.h"
 #include "hermes/VM/WeakRef.h"
 
+#include <deque>
 #include <functional>
 #include <new>
 #include <vector>
@@ -481,6 +482,19 @@ TEST_F(GCBasicsTest, TestIDDeathInYoung) {
   // ~DummyRuntime will verify all pointers in ID map.
 }
 
+TEST_F(GCBasicsTest, TimeHistogramsRecordCollections) {
+  GC::HeapInfo info;
+  rt.getHeap().getHeapInfo(info);
+  EXPECT_EQ(0u, info.timeHistograms.oldGenPause.count());
+  rt.collect();
+  rt.getHeap().getHeapInfo(info);
+  // Every GC stops the world for at least part of a full collection.
+  EXPECT_GE(info.timeHistograms.oldGenPause.count(), 1u);
+#ifdef HERMESVM_GC_HADES
+  EXPECT_EQ(1u, info.timeHistograms.concurrent.count());
+#endif
+}
+
 // Hades doesn't do any GCEventKind monitoring.
 TEST(GCCallbackTest, TestCallbackInvoked) {
   std::vector<GCEventKind> ev;
@@ -551,4 +565,80 @@ TEST(GCBasicsTestNCGen, TestIDPersistsAcrossMultipleCollections) {
 }
 #endif
 
+#ifdef HERMESVM_GC_HADES
+TEST(GCBasicsTestHades, WeakSlotStorageReusesFreedSlots) {
+  GC::WeakSlotStorage storage;
+  // The slots are never dereferenced, so any aligned pointer will do.
+  auto fakeObject = [](size_t i) {
+    return HermesValue::encodeObjectValue((void *)(0x10000 + i * 16));
+  };
+  // Span several chunks, and check that growing never moves a slot.
+  constexpr size_t kNumSlots = 1000;
+  std::vector<WeakRefSlot *> slots;
+  for (size_t i = 0; i < kNumSlots; ++i)
+    slots.push_back(storage.alloc(fakeObject(i)));
+  for (size_t i = 0; i < kNumSlots; ++i)
+    EXPECT_EQ(fakeObject(i), slots[i]->value());
+  size_t numSlots = 0;
+  storage.forEach([&numSlots](WeakRefSlot &) { numSlots++; });
+  EXPECT_EQ(kNumSlots, numSlots);
+  EXPECT_GE(storage.mallocSize(), kNumSlots * sizeof(WeakRefSlot));
+
+  // Freed slots are handed out again before any new ones are created, most
+  // recently freed first.
+  const size_t mallocSizeBefore = storage.mallocSize();
+  storage.free(slots[10]);
+  storage.free(slots[500]);
+  EXPECT_EQ(WeakSlotState::Free, slots[10]->state());
+  EXPECT_EQ(slots[500], storage.alloc(fakeObject(0)));
+  EXPECT_EQ(slots[10], storage.alloc(fakeObject(1)));
+  EXPECT_EQ(mallocSizeBefore, storage.mallocSize());
+  numSlots = 0;
+  storage.forEach([&numSlots](const WeakRefSlot &) { numSlots++; });
+  EXPECT_EQ(kNumSlots, numSlots);
+}
+
+/// WeakRefs created while an old gen collection is running concurrently,
+/// including after its weak roots have been marked but before the unmarked
+/// slots are reclaimed, must not have their slots freed.
+TEST(GCBasicsTestHades, WeakRefsCreatedDuringCollectionSurvive) {
+  auto runtime =
+      DummyRuntime::create(getMetadataTable(), TestGCConfigFixedSize(1 << 25));
+  DummyRuntime &rt = *runtime;
+  auto &gc = rt.getHeap();
+
+  // Keep a rotating window of arrays alive, so that enough of them are
+  // promoted to start several old gen collections.
+  constexpr size_t kWindow = 4000;
+  constexpr size_t kNumAllocs = 100000;
+  std::vector<GCCell *> window(kWindow, nullptr);
+  for (GCCell *&cell : window)
+    rt.pointerRoots.push_back(&cell);
+  std::deque<WeakRef<Array>> weakRefs;
+  rt.markExtraWeak = [&weakRefs](WeakRefAcceptor &acceptor) {
+    for (WeakRef<Array> &wr : weakRefs)
+      acceptor.accept(wr);
+  };
+
+  GC::HeapInfo info;
+  gc.getHeapInfo(info);
+  const unsigned numGCsBefore = info.numCollections;
+  for (size_t i = 0; i < kNumAllocs; ++i) {
+    auto *arr = Array::create(rt, 100);
+    window[i % kWindow] = arr;
+    if (i % 16 == 0) {
+      WeakRefLock lk{gc.weakRefMutex()};
+      weakRefs.emplace_back(&gc, arr);
+    }
+  }
+  rt.collect();
+  gc.getHeapInfo(info);
+  EXPECT_GT(info.numCollections, numGCsBefore);
+
+  WeakRefLock lk{gc.weakRefMutex()};
+  for (WeakRef<Array> &wr : weakRefs)
+    ASSERT_NE(WeakSlotState::Free, wr.unsafeGetSlot()->state());
+}
+#endif
+
 } // namespace
@@ -324,4 +324,73 @@ TEST_F(StringPrimTest, FastConcatTest) {
   EXPECT_TRUE(utf16Ref.size() == utfStr3.size());
   EXPECT_TRUE(std::equal(utfStr3.begin(), utfStr3.end(), utf16Ref.begin()));
 }
+
+TEST_F(StringPrimTest, SliceSharesStorageTest) {
+  std::string bigStr;
+  for (uint32_t i = 0; i < StringPrimitive::EXTERNAL_STRING_THRESHOLD; ++i)
+    bigStr.push_back('a' + i % 26);
+  auto big = StringPrimitive::createNoThrow(runtime, bigStr);
+  ASSERT_TRUE(big->isExternal());
+  // The cell may move, so don't hold on to a raw pointer to it.
+  auto bigBuffer = [&big]() {
+    return vmcast<ExternalASCIIStringPrimitive>(big.get());
+  };
+
+  const uint32_t len = StringPrimitive::SLICE_STRING_MIN_SIZE;
+  auto cr = StringPrimitive::slice(runtime, big, 100, 2 * len);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  auto slice1 = runtime->makeHandle<BufferedASCIIStringPrimitive>(*cr);
+  EXPECT_EQ(bigBuffer(), slice1->testGetConcatBuffer());
+  auto ref = slice1->getStringRef<char>();
+  EXPECT_EQ(bigStr.substr(100, 2 * len), std::string(ref.begin(), ref.end()));
+
+  // A slice of a slice refers to the original storage.
+  cr = StringPrimitive::slice(runtime, slice1, 10, len);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  auto slice2 = runtime->makeHandle<BufferedASCIIStringPrimitive>(*cr);
+  EXPECT_EQ(bigBuffer(), slice2->testGetConcatBuffer());
+  ref = slice2->getStringRef<char>();
+  EXPECT_EQ(bigStr.substr(110, len), std::string(ref.begin(), ref.end()));
+
+  // Small slices are copied.
+  cr = StringPrimitive::slice(runtime, slice1, 10, len - 1);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  EXPECT_FALSE(isBufferedStringPrimitive(cr->getString()));
+  ref = cr->getString()->getStringRef<char>();
+  EXPECT_EQ(bigStr.substr(110, len - 1), std::string(ref.begin(), ref.end()));
+
+  // Concatenating to a slice that ends at the end of the original string must
+  // not append to its storage.
+  cr = StringPrimitive::slice(runtime, big, bigStr.size() - len, len);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  auto tail = runtime->makeHandle<BufferedASCIIStringPrimitive>(*cr);
+  cr = StringPrimitive::concat(
+      runtime, tail, StringPrimitive::createNoThrow(runtime, "small"));
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  auto concat = runtime->makeHandle<BufferedASCIIStringPrimitive>(*cr);
+  EXPECT_NE(bigBuffer(), concat->testGetConcatBuffer());
+  ref = concat->getStringRef<char>();
+  EXPECT_EQ(
+      bigStr.substr(bigStr.size() - len) + "small",
+      std::string(ref.begin(), ref.end()));
+  EXPECT_EQ(bigStr.size(), bigBuffer()->getStringLength());
+  ref = big->getStringRef<char>();
+  EXPECT_EQ(bigStr, std::string(ref.begin(), ref.end()));
+
+  // Slices of UTF16 strings.
+  std::u16string bigUTF16(bigStr.begin(), bigStr.end());
+  bigUTF16[200] = u'\u1234';
+  auto bigU = StringPrimitive::createNoThrow(
+      runtime, UTF16Ref(bigUTF16.data(), bigUTF16.size()));
+  ASSERT_TRUE(bigU->isExternal());
+  cr = StringPrimitive::slice(runtime, bigU, 100, len);
+  ASSERT_NE(ExecutionStatus::EXCEPTION, cr);
+  auto sliceU = runtime->makeHandle<BufferedUTF16StringPrimitive>(*cr);
+  EXPECT_EQ(
+      vmcast<ExternalUTF16StringPrimitive>(bigU.get()),
+      sliceU->testGetConcatBuffer());
+  auto refU = sliceU->getStringRef<char16_t>();
+  EXPECT_EQ(
+      bigUTF16.substr(100, len), std::u16string(refU.begin(), refU.end()));
+}
 } // namespace
@@ -136,6 +136,51 @@ TEST_F(StringViewTest, Slice) {
   }
 }
 
+TEST_F(StringViewTest, Find) {
+  auto asciiPrim = StringPrimitive::createNoThrow(runtime, "hello, hello");
+  auto ascii = StringPrimitive::createStringView(runtime, asciiPrim);
+  auto helloPrim = StringPrimitive::createNoThrow(runtime, "hello");
+  auto hello = StringPrimitive::createStringView(runtime, helloPrim);
+  auto emptyPrim = StringPrimitive::createNoThrow(runtime, "");
+  auto empty = StringPrimitive::createStringView(runtime, emptyPrim);
+
+  EXPECT_EQ(0u, *ascii.find(hello));
+  EXPECT_EQ(7u, *ascii.find(hello, 1));
+  EXPECT_FALSE(ascii.find(hello, 8));
+  EXPECT_FALSE(hello.find(ascii));
+  EXPECT_EQ(3u, *ascii.find(empty, 3));
+  EXPECT_EQ(ascii.length(), *ascii.find(empty, ascii.length()));
+  EXPECT_EQ(0u, *empty.find(empty));
+
+  // The high byte of \u0a61 is '\n' and its low byte is 'a', so scanning for
+  // either byte finds candidates that aren't matches.
+  auto utf16Prim = StringPrimitive::createNoThrow(
+      runtime, createUTF16Ref(u"\u0a61\u0a61a\n\u0100hello"));
+  auto utf16 = StringPrimitive::createStringView(runtime, utf16Prim);
+  ASSERT_FALSE(utf16.isASCII());
+  auto aPrim = StringPrimitive::createNoThrow(runtime, "a");
+  EXPECT_EQ(2u, *utf16.find(StringPrimitive::createStringView(runtime, aPrim)));
+  auto newlinePrim = StringPrimitive::createNoThrow(runtime, "\n");
+  EXPECT_EQ(
+      3u,
+      *utf16.find(StringPrimitive::createStringView(runtime, newlinePrim)));
+  EXPECT_EQ(5u, *utf16.find(hello));
+  auto u0100Prim =
+      StringPrimitive::createNoThrow(runtime, createUTF16Ref(u"\u0100"));
+  auto u0100 = StringPrimitive::createStringView(runtime, u0100Prim);
+  EXPECT_EQ(4u, *utf16.find(u0100));
+  auto u0a00Prim =
+      StringPrimitive::createNoThrow(runtime, createUTF16Ref(u"\u0a00"));
+  EXPECT_FALSE(
+      utf16.find(StringPrimitive::createStringView(runtime, u0a00Prim)));
+
+  // A UTF16 needle is only found in an ASCII string if it is all ASCII.
+  EXPECT_FALSE(ascii.find(u0100));
+  auto utf16Hello = utf16.slice(5);
+  ASSERT_FALSE(utf16Hello.isASCII());
+  EXPECT_EQ(7u, *ascii.find(utf16Hello, 1));
+}
+
 TEST_F(StringViewTest, Output) {
   auto str = createUTF16Ref(u"abcd");
   llvh::SmallVector<char, 32> result{};